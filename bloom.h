@@ -0,0 +1,45 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include "heapfile.h"
+
+
+// A Bloom filter over the values of one join attribute. An equi-join
+// adds every join attribute value of its build side and hands the
+// filter to the scans of the probe side, which then drop tuples whose
+// value is certainly not on the build side before they are read,
+// partitioned, sorted or probed. A value that was added always passes;
+// a value that was not passes with a small probability.
+
+class BloomFilter {
+ public:
+  BloomFilter(const int keyCnt,         // expected number of values
+	      const Datatype type,      // type of the attribute
+	      const int length);        // length of the attribute
+  ~BloomFilter();
+
+  void add(const char* attr);           // add an attribute value
+  void clear();                         // forget all values added
+
+  // true if attr may have been added; counted in the statistics
+  const bool mayContain(const char* attr) const;
+
+  const int getProbeCnt() const { return probeCnt; }
+  const int getPassCnt() const { return passCnt; }
+
+  // print how many probes passed and how many were eliminated
+  void report() const;
+
+ private:
+  // hash attr into two independent values for double hashing
+  void hash(const char* attr, unsigned int & h1, unsigned int & h2) const;
+
+  unsigned int* bits;                   // the bit array
+  unsigned int mask;                    // number of bits - 1
+  Datatype type;
+  int length;
+  mutable int probeCnt;                 // calls of mayContain()
+  mutable int passCnt;                  // ... that returned true
+};
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include <vector>
+#include "catalog.h"
+
+
+// define if debug output wanted
+//#define DEBUGBTREE
+
+
+// B+-tree index on one attribute of a relation, stored in a file of its
+// own (the same file name a hash index on the attribute would have).
+// Leaves hold entries of the RID of a tuple and its value of the
+// attribute, in key order, and are chained left to right so that a
+// range scan reads one leaf after the other. An inner node holds
+// separator keys and the pages of its children: its leftmost child,
+// and for each separator the child whose keys are >= it. Equal keys
+// may be spread over several leaves. Deleting entries does not merge
+// nodes; a leaf may become empty and is then skipped by scans.
+//
+// While the index is open its header page stays pinned; it is written
+// back by the destructor. The nodes are ordinary buffer pool pages.
+
+class BTreeIndex {
+ public:
+  // open the index on attr of relation
+  BTreeIndex(const string & relation, const AttrDesc & attr, Status & status);
+  ~BTreeIndex();                        // write back header, close
+
+  // create an empty index: a root that is a leaf
+  static const Status create(const string & relation, const AttrDesc & attr);
+  static const Status destroy(const string & relation,
+			      const string & attrName);
+
+  // fill an empty index with the tuples of relation, bottom up from
+  // their keys sorted by SortedFile
+  const Status bulkLoad(const string & relation);
+
+  const Status insertEntry(const char *key, const RID & rid);
+  const Status deleteEntry(const char *key, const RID & rid);
+
+  // RIDs of the entries whose key k satisfies "k op key", in key order;
+  // scanNext returns NOMORERECS after the last one. NE is not supported.
+  // A string key of keyLen bytes, shorter than the attribute, compares
+  // over keyLen bytes, like strncmp: "k = key" holds for every k that
+  // key is a prefix of.
+  const Status startScan(const char *key, const Operator op,
+			 const int keyLen = 0);
+  const Status scanNext(RID & rid);
+  const Status endScan();
+
+  int getEntryCnt() const { return hdr->entryCnt; }
+  int getLeafCnt() const { return hdr->leafCnt; }
+  int getInnerCnt() const { return hdr->innerCnt; }
+  int getHeight() const { return hdr->height; }
+
+ private:
+  typedef struct {
+    int keyOffset;                      // attribute in the relation
+    int keyLen;
+    int keyType;
+    int root;                           // page of the root node
+    int height;                         // levels, 1 if the root is a leaf
+    int entryCnt;
+    int leafCnt;
+    int innerCnt;                       // inner nodes
+  } HDR;
+
+  // A node page. Leaf entries are the RID followed by the key; inner
+  // node entries are a child page followed by its separator key.
+  typedef struct {
+    int level;                          // 0 for a leaf
+    int entryCnt;
+    int next;                           // leaf: next leaf, -1 if none;
+                                        // inner node: leftmost child
+    char entries[PAGESIZE - 3 * sizeof(int)];
+  } NODE;
+
+  // strings compare over len bytes, or over the key length if len is 0
+  int compare(const char *key1, const char *key2, const int len = 0) const;
+  // first entry of node whose key is >= key, or > key if upper is set
+  int position(const NODE *node, const char *key, const bool upper,
+	       const int len = 0) const;
+  // child of an inner node to descend to for key, or the leftmost child
+  // if key is NULL
+  int child(const NODE *node, const char *key, const bool upper,
+	    const int len = 0) const;
+  const Status readNode(const int pageNo, NODE *&node);
+  const Status newNode(const int level, int & pageNo, NODE *&node);
+  // the leaf for key, pinned, and the inner nodes above it
+  const Status findLeaf(const char *key, const bool upper, int & pageNo,
+			NODE *&leaf, vector<int> *path, const int len = 0);
+  // split the full node at pageNo while inserting entry at slot pos;
+  // returns the new right node and the key that separates it
+  const Status split(const int pageNo, NODE *node, const int pos,
+		     const char *entry, int & right, char *sepKey);
+  // add separator key with child right to the inner node at pageNo,
+  // splitting it and the nodes above it as needed
+  const Status insertInner(vector<int> & path, const char *key,
+			   const int right);
+  // add a level of nodes above the given ones, whose first keys are
+  // in keys; on return they describe the new level
+  const Status buildLevel(const int level, vector<int> & pages,
+			  vector<char> & keys);
+
+  File *file;
+  int hdrPageNo;
+  HDR *hdr;                             // pinned header page
+  bool hdrDirty;
+  int leafLen;                          // bytes per leaf entry
+  int innerLen;                         // bytes per inner node entry
+  int leafCap;                          // entries per leaf
+  int innerCap;                         // entries per inner node
+
+  // state of the scan
+  char scanKey[MAXSTRINGLEN + 1];
+  Operator scanOp;
+  int scanLen;                          // bytes of a string compared
+  int scanPageNo;
+  NODE *scanPage;                       // pinned, or NULL
+  int scanSlot;                         // next entry to look at
+};
+
+#endif
@@ -1,6 +1,9 @@
 #ifndef BUF_H
 #define BUF_H
 
+#include <stdio.h>
+#include <sys/time.h>
+#include <unordered_map>
 #include "db.h"
 // define if debug output wanted
 //#define DEBUGBUF
@@ -82,12 +85,16 @@ private:
 struct BufStats
 {
   int accesses;    // Total number of accesses to buffer pool
-  int diskreads;   // Number of pages read from disk (including allocs)
+  int diskreads;   // Number of pages read from disk
   int diskwrites;  // Number of pages written back to disk
+  int hits;        // Number of readPage calls that found the page
+  int allocs;      // Number of pages allocated
+  int peakPinned;  // Most frames pinned at once
 
   void clear()
     {
       accesses = diskreads = diskwrites = 0;
+      hits = allocs = peakPinned = 0;
     }
       
   BufStats()
@@ -97,6 +104,28 @@ struct BufStats
 };
 
 
+// A trace of the page accesses of a BufMgr (see BufMgr::startTrace):
+// TRACEMAGIC and the number of frames of the pool (an int), followed
+// by TraceRecs. Before its first access a file is named by a TR_FILE
+// record: its file field is the number the trace uses for the file
+// from then on, pageNo is the length of the name, and the name itself
+// follows the record. TR_DIRTY is an unpin of a page that was changed.
+
+#define TRACEMAGIC "MRTRACE1"
+
+enum TraceOp {TR_READ, TR_ALLOC, TR_UNPIN, TR_DIRTY, TR_FLUSH, TR_DISPOSE,
+	      TR_FILE};
+
+struct TraceRec
+{
+  unsigned int usec;     // microseconds since the trace started
+  int pageNo;            // page within the file, -1 for TR_FLUSH
+  unsigned short file;   // number of the file in the trace
+  unsigned char op;      // a TraceOp
+  unsigned char hit;     // TR_READ: 1 if the page was in the pool
+};
+
+
 class BufMgr 
 {
 private:
@@ -105,6 +134,8 @@ private:
   BufHashTbl*    hashTable;  	// hash table mapping (File, page) to frame
   BufDesc*	 bufTable;  	// vector of status info, 1 per page
   BufStats	 bufStats;	// buffer pool statistics
+  int		 pinnedBufs;	// frames with a pin count above 0
+  mutable recursive_mutex mutex;	// serializes threads (parallel sort)
 
   const Status allocBuf(int & frame);   // allocate a free frame.  
   const void releaseBuf(int frame); // return unused frame to end of list
@@ -112,6 +143,17 @@ private:
   {
 	clockHand = (clockHand + 1) % numBufs;
   }
+  void pinned()				// a frame got its first pin
+  {
+	if (++pinnedBufs > bufStats.peakPinned)
+	  bufStats.peakPinned = pinnedBufs;
+  }
+
+  FILE*		 trace;		// trace file, NULL if not tracing
+  struct timeval traceStart;
+  unordered_map<string, unsigned short> traceFiles; // numbers of files
+  void traceOp(const File* file, const int pageNo, const TraceOp op,
+	       const bool hit = false);
 
 
 public:
@@ -122,9 +164,11 @@ public:
 
   const Status readPage(File* file, const int PageNo, Page*& page);
   const Status unPinPage(File* file, const int PageNo, const bool dirty);
+  const Status markDirty(File* file, const int PageNo); // pinned page changed
   const Status allocPage(File* file, int& PageNo, Page*& page); 
                         // allocates a new, empty page 
   const Status flushFile(const File* file); // writing out all dirty pages of the file
+  const Status flushLogged(); // write pages of logged files, keep them cached
   const Status disposePage(File* file, const int PageNo); // dispose of page in file
   void  printSelf();
 
@@ -135,7 +179,23 @@ public:
   const void clearBufStats() 
   {
 	bufStats.clear();
+	bufStats.peakPinned = pinnedBufs;
   }
+  // Start bufStats.peakPinned over from peak, or from the frames
+  // pinned now if that is more. EXPLAIN ANALYZE takes the peak of
+  // each operator this way.
+  void setPeakPinned(const int peak)
+  {
+	bufStats.peakPinned = peak > pinnedBufs ? peak : pinnedBufs;
+  }
+
+  // log every page access to fileName from now on, until stopTrace
+  const Status startTrace(const string & fileName);
+  const Status stopTrace();
+
+  // number of frames that are not pinned right now; operators use it
+  // to size their memory budget (hash tables, sort runs, blocks)
+  const int numUnpinnedBufs() const;
 };
 
 #endif
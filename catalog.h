@@ -1,6 +1,8 @@
 #ifndef CATALOG_H
 #define CATALOG_H
 
+#include <unordered_map>
+#include <vector>
 #include "heapfile.h"
 
 
@@ -17,11 +19,15 @@
 // schema of relation catalog:
 //   relation name : char(32)           <-- lookup key
 //   attribute count : integer(4)
+//   page count : integer(4)            <-- statistics, -1 until the
+//   tuple count : integer(4)           <-- relation is analyzed
 
 
 typedef struct {
   char relName[MAXNAME];                // relation name
   int attrCnt;                          // number of attributes
+  int pageCnt;                          // pages, as of the last analyze
+  int tupleCnt;                         // tuples, as of the last analyze
 } RelDesc;
 
 
@@ -34,6 +40,12 @@ typedef struct {
 } attrInfo; 
 
 
+// Both catalogs keep all their tuples in memory as well, hashed on the
+// relation name: they are read once when the catalog is opened, and
+// addInfo, removeInfo and updateInfo change the cached tuples along
+// with the ones on disk. getInfo and getRelInfo are answered from
+// memory and read no pages.
+
 class RelCatalog : public HeapFile {
  public:
   // open relation catalog
@@ -48,19 +60,45 @@ class RelCatalog : public HeapFile {
   // remove tuple from catalog
   const Status removeInfo(const string & relation);
 
-  // create a new relation
+  // overwrite the tuple of record.relName with record
+  const Status updateInfo(const RelDesc & record);
+
+  // create a new relation; the STRING attributes i with encoded[i]
+  // set, if encoded is given, are stored dictionary encoded
   const Status createRel(const string & relation, 
 		   const int attrCnt, 
-		   const attrInfo attrList[]);
+		   const attrInfo attrList[],
+		   const bool encoded[] = NULL);
 
   // destroy a relation
   const Status destroyRel(const string & relation);
 
+  // build an index of type indexType (an IndexType) on an attribute;
+  // numBuckets is for hash indexes, 0 sizes it for the relation
+  const Status addIndex(const string & relation,
+			const string & attrName,
+			const int indexType,
+			const int numBuckets);
+
+  // drop the index on an attribute, or all indexes of the relation
+  // if attrName is empty
+  const Status dropIndex(const string & relation,
+			 const string & attrName);
+
+  // collect the statistics of a relation, or of every relation if
+  // relation is empty
+  const Status analyze(const string & relation);
+
   // print catalog information
   const Status help(const string & relation);          // relation may be NULL
 
   // get rid of catalog
   ~RelCatalog();
+
+ private:
+  const Status loadCache();             // read all tuples into relCache
+
+  unordered_map<string, RelDesc> relCache;
 };
 
 
@@ -70,6 +108,21 @@ class RelCatalog : public HeapFile {
 //   attribute number : integer(4)
 //   attribute type : integer(4)  (type is Datatype actually)
 //   attribute size : integer(4)
+//   index type : integer(4)  (type is IndexType actually)
+//   dictionary length : integer(4)
+//   distinct values : integer(4)       <-- statistics, -1 until the
+//   histogram : HISTBUCKETS + 1 reals  <-- relation is analyzed
+
+
+// index kept on an attribute
+enum IndexType {NoIndex, HashIndexed, BTreeIndexed};
+
+
+// Buckets of the equi-depth histogram of an attribute. Bucket i holds
+// the values from histBounds[i] to histBounds[i + 1]; every bucket has
+// about the same number of tuples. The bounds are the values mapped
+// to reals by ST_histKey (stats.h).
+#define HISTBUCKETS  8
 
 
 typedef struct {
@@ -78,6 +131,12 @@ typedef struct {
   int attrOffset;                       // attribute offset
   int attrType;                         // attribute type
   int attrLen;                          // attribute length
+  int indexed;                          // index on attribute, if any
+  int dictLen;                          // > 0: a char(dictLen) stored
+                                        // as a dictionary code (dict.h)
+  int distinctCnt;                      // distinct values, as of the
+                                        // last analyze
+  float histBounds[HISTBUCKETS + 1];    // histogram, ditto
 } AttrDesc;
 
 
@@ -99,6 +158,9 @@ class AttrCatalog : public HeapFile {
   // remove tuple from catalog
   const Status removeInfo(const string & relation, const string & attrName);
 
+  // overwrite the tuple of record.relName, record.attrName with record
+  const Status updateInfo(const AttrDesc & record);
+
   // get all attributes of a relation
   const Status getRelInfo(const string & relation, 
 			  int &attrCnt, 
@@ -109,13 +171,20 @@ class AttrCatalog : public HeapFile {
 
   // close attribute catalog
   ~AttrCatalog();
+
+ private:
+  const Status loadCache();             // read all tuples into attrCache
+
+  // the attributes of each relation, in the order of their tuples
+  unordered_map<string, vector<AttrDesc> > attrCache;
 };
 
 
 extern RelCatalog  *relCat;
 extern AttrCatalog *attrCat;
 extern Error error;
-extern Status createHeapFile(const string filename);
+extern Status createHeapFile(const string filename,
+			     const bool temporary = false);
 extern Status destroyHeapFile(const string filename);
 
 #endif
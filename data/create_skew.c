@@ -0,0 +1,38 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct {
+  int unique1;
+  int unique2;
+  int hundred1;
+  int hundred2;
+  char dummy[84];
+} Rels;
+
+
+/* create skew: like rel1000, but 900 of the 1000 tuples have
+   unique1 = 8, so a hash partition on unique1 cannot be balanced */
+
+int main()
+{
+  FILE *fp;
+  int i;
+
+  fp = fopen("skew.data","wb");
+
+  Rels rel;
+  memset(rel.dummy, ' ', sizeof(rel.dummy));
+  for (i = 0; i < 1000; i++) {
+	rel.unique1 = (i % 10) ? 8 : rand() % 1000 + 1;
+	rel.unique2 = rand() % 1000 + 1;
+	rel.hundred1 = rand() % 100 + 1;
+	rel.hundred2 = rand() % 100 + 1;
+	sprintf(rel.dummy, "skew.%3d", i);
+	if (fwrite((void*)&rel, sizeof(rel), 1, fp) < 1)
+		fprintf(stderr, "Error in creating file\n");
+  }
+  fclose(fp);
+  return 0;
+}
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+typedef struct {
+  int unique1;
+  int unique2;
+  int hundred1;
+  int hundred2;
+  char dummy[84];
+} Rels;
+
+
+/* genrel: writes a relation of any size in the format of rel1000.data,
+   for tuples of (unique1 int, unique2 int, hundred1 int, hundred2 int,
+   dummy char(84)).
+
+   usage: genrel tuples file [unique|uniform|zipf [seed]]
+
+   unique2 is 0 .. tuples-1 in order, hundred1 and hundred2 are random
+   in 1 .. 100 and dummy is "file.i". unique1 is the join attribute:
+   0 .. tuples-1 shuffled (unique, like genWITuples), random in
+   0 .. tuples-1 (uniform), or zipf distributed over 0 .. tuples-1
+   with exponent 1, so that value 0 is the most frequent (zipf; a
+   heavier version of skew.data).
+
+   If file ends in .csv, the tuples are written as text instead, one a
+   line with their fields separated by commas, for load ... delimited. */
+
+static int *shuffled(int n)
+{
+  int *keys = malloc(n * sizeof(int));
+  int i;
+
+  for (i = 0; i < n; i++)
+	keys[i] = i;
+  for (i = n - 1; i > 0; i--) {
+	int j = rand() % (i + 1);
+	int k = keys[i]; keys[i] = keys[j]; keys[j] = k;
+  }
+  return keys;
+}
+
+/* zipf by inversion of the cumulative distribution, which is
+   computed once */
+static double *zipfCdf(int n)
+{
+  double *cdf = malloc(n * sizeof(double));
+  double sum = 0;
+  int i;
+
+  for (i = 0; i < n; i++)
+	cdf[i] = (sum += 1.0 / (i + 1));
+  for (i = 0; i < n; i++)
+	cdf[i] /= sum;
+  return cdf;
+}
+
+static int zipf(const double *cdf, int n)
+{
+  double u = (double) rand() / ((double) RAND_MAX + 1);
+  int lo = 0, hi = n - 1;
+
+  while (lo < hi) {
+	int mid = (lo + hi) / 2;
+	if (cdf[mid] < u) lo = mid + 1;
+	else hi = mid;
+  }
+  return lo;
+}
+
+int main(int argc, char *argv[])
+{
+  FILE *fp;
+  int i, n, csv;
+  const char *dist;
+  int *keys = NULL;
+  double *cdf = NULL;
+  Rels rel;
+
+  if (argc < 3 || (n = atoi(argv[1])) <= 0) {
+	fprintf(stderr, "usage: %s tuples file [unique|uniform|zipf [seed]]\n",
+		argv[0]);
+	return 1;
+  }
+  dist = (argc > 3) ? argv[3] : "unique";
+  srand((argc > 4) ? atoi(argv[4]) : 1);
+
+  if (!strcmp(dist, "unique"))
+	keys = shuffled(n);
+  else if (!strcmp(dist, "zipf"))
+	cdf = zipfCdf(n);
+  else if (strcmp(dist, "uniform")) {
+	fprintf(stderr, "%s: unknown distribution %s\n", argv[0], dist);
+	return 1;
+  }
+
+  csv = strlen(argv[2]) > 4 && !strcmp(argv[2] + strlen(argv[2]) - 4, ".csv");
+  if (!(fp = fopen(argv[2], "wb"))) {
+	perror(argv[2]);
+	return 1;
+  }
+
+  memset(rel.dummy, ' ', sizeof(rel.dummy));
+  for (i = 0; i < n; i++) {
+	if (keys) rel.unique1 = keys[i];
+	else if (cdf) rel.unique1 = zipf(cdf, n);
+	else rel.unique1 = rand() % n;
+	rel.unique2 = i;
+	rel.hundred1 = rand() % 100 + 1;
+	rel.hundred2 = rand() % 100 + 1;
+	snprintf(rel.dummy, sizeof(rel.dummy), "%s.%d", argv[2], i);
+	if (csv ? fprintf(fp, "%d,%d,%d,%d,%s\n", rel.unique1, rel.unique2,
+			  rel.hundred1, rel.hundred2, rel.dummy) < 0
+		: fwrite((void*)&rel, sizeof(rel), 1, fp) < 1) {
+		fprintf(stderr, "Error in creating file\n");
+		return 1;
+	}
+  }
+  fclose(fp);
+  free(keys);
+  free(cdf);
+  return 0;
+}
@@ -5,6 +5,8 @@
 #include <functional>
 #include "error.h"
 #include <string.h>
+#include <mutex>
+#include <unordered_set>
 using namespace std;
 
 // define if debug output wanted
@@ -29,6 +31,8 @@ class File {
   const Status writePage(const int pageNo,
 		   const Page* pagePtr);      // write page to file
   const Status getFirstPage(int& pageNo) const;     // returns pageNo of first page
+  const string & getName() const { return fileName; } // name of the file
+  bool isLogged() const { return logged; }  // written through the log
 
   bool operator == (const File & other) const
     {
@@ -58,11 +62,15 @@ class File {
   string fileName;                    // The name of the file
   int openCnt;                        // # times file has been opened
   int unixFile;                       // unix file stream for file
+  bool logged;                        // pages go to logMgr (see wal.h)
 };
 
 class BufMgr;
 extern BufMgr* bufMgr;
 
+class LogMgr;
+extern LogMgr* logMgr;                // NULL if nothing is logged
+
 // declarations for hash table of open files
 struct fileHashBucket
 {
@@ -98,12 +106,17 @@ public:
 
 
 
+// A file is logged (see wal.h) if there is a logMgr and the file was
+// not created temporary; temporary files (sort runs, partitions) need
+// not survive a crash.
+
 class DB {
  public:
   DB();                                 // initialize open file table
   ~DB();                                // clean up any remaining open files
 
-  const Status createFile(const string & fileName) ;  // create a new file
+  const Status createFile(const string & fileName,  // create a new file
+			  const bool temporary = false);
   const Status destroyFile(const string & fileName) ; // destroy a file, 
                                                            // release all space
   const Status openFile(const string & fileName, File* & file);  // open a file
@@ -111,6 +124,8 @@ class DB {
 
  private:
   OpenFileHashTbl   openFiles;    // list of open files
+  unordered_set<string> temporary; // files created temporary, not logged
+  recursive_mutex   mutex;        // serializes threads (parallel sort)
 };
 
 
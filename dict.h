@@ -0,0 +1,64 @@
+#ifndef DICT_H
+#define DICT_H
+
+#include <unordered_map>
+#include <vector>
+#include "catalog.h"
+
+
+#define DICTNAME     "dictionary"       // name of the dictionary file
+
+
+// Dictionary encoding of string attributes. An attribute created as
+// "char(n) dictionary" is stored as an INTEGER, the code of its string
+// in the dictionary, and its AttrDesc has dictLen n. Equal strings get
+// equal codes, so equality predicates, joins, hashing, sorting and the
+// indexes all work on the 4-byte codes; the strings are only looked at
+// to turn a constant of a predicate into codes and to print a tuple.
+// Codes are not in the order of their strings: a range predicate is
+// turned into the set of codes of the strings in the range (match).
+//
+// There is one dictionary per database, shared by all the encoded
+// attributes, so that a string has the same code in every relation and
+// a join of two encoded attributes compares codes. It is the heap file
+// DICTNAME next to the catalogs, one tuple per string:
+//   code : integer(4)
+//   string : up to n characters and a null
+// Strings are never removed. Like the catalogs, the dictionary keeps
+// all its strings in memory as well, read once when it is opened; its
+// file is only open while that is done and while a string is added,
+// so that it holds no frames of the buffer pool in between.
+
+class Dictionary {
+ public:
+  // open the dictionary, creating it in a database that has none yet
+  Dictionary(Status &status);
+
+  // the code of value, a string of at most length characters, which
+  // is added to the dictionary if it is not in it yet
+  const Status encode(const char *value, const int length, int &code);
+
+  // the code of value, or -1 if the dictionary does not have it
+  int lookup(const char *value, const int length) const;
+
+  // the string of a code
+  const char *decode(const int code) const;
+
+  // selected[c] is set for the codes c of the strings s for which
+  // "s op value" holds, s and value compared like strncmp over length
+  void match(const Operator op, const char *value, const int length,
+	     vector<bool> & selected) const;
+
+  ~Dictionary();
+
+ private:
+  const Status loadCache();             // read all tuples into strings
+
+  unordered_map<string, int> codes;
+  vector<string> strings;               // the string of each code
+};
+
+
+extern Dictionary *dict;
+
+#endif
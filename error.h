@@ -17,7 +17,7 @@ enum Status {
 // File and DB errors
 
        BADFILEPTR, BADFILE, FILETABFULL, FILEOPEN, FILENOTOPEN,
-       UNIXERR, BADPAGEPTR, BADPAGENO, FILEEXISTS,
+       UNIXERR, BADPAGEPTR, BADPAGENO, FILEEXISTS, BADLOG,
 
 // BufMgr and HashTable errors
 
@@ -49,9 +49,11 @@ enum Status {
 
 // Utility errors
 
+       BADLOADLINE,
+
 // Query errors
 
-       ATTRTYPEMISMATCH, TMP_RES_EXISTS,
+       ATTRTYPEMISMATCH, TMP_RES_EXISTS, ENCODEDRANGE,
 
 // do not touch filler -- add codes before it
 
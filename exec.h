@@ -0,0 +1,221 @@
+#ifndef EXEC_H
+#define EXEC_H
+
+#include "catalog.h"
+#include "hashindex.h"
+#include "btree.h"
+#include "sort.h"
+
+
+// A query is run as a tree of plan nodes, each an iterator: open()
+// sets a node up (and does whatever it has to do before its first
+// tuple can come out, like sorting or building a hash table), next()
+// returns one tuple at a time and FILEEOF after the last one, and
+// close() releases everything and prints the statistics of the node.
+// A tuple returned by next() stays valid until the following call of
+// next() on the same node. A node owns its inputs and deletes them.
+// The nodes implement doOpen(), doNext() and doClose(), which open(),
+// next() and close() call.
+//
+// The root of the tree is run by ExecPlan(), which sends the tuples
+// straight to the printer or into the result relation, so results are
+// no longer stored in a temporary relation to be printed from there.
+
+class Profile;
+
+class PlanNode {
+ public:
+  PlanNode() : entry(-1) {}
+  virtual ~PlanNode() {}
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+  // what the node does, for EXPLAIN ANALYZE; after open() it may add
+  // figures of its own, like the number of runs of a sort
+  virtual string describe() const = 0;
+
+  // set while ExecPlan runs a plan for EXPLAIN ANALYZE
+  static Profile *profile;
+
+ protected:
+  virtual const Status doOpen() = 0;
+  virtual const Status doNext(Record & rec) = 0;
+  virtual const Status doClose() = 0;
+
+ private:
+  int entry;                            // of the node in profile, or -1
+};
+
+
+// The figures of a plan node for EXPLAIN ANALYZE. They are taken
+// around every call of open(), next() and close() of the node, so they
+// include the work of its inputs; tuplesIn only counts heap files that
+// have been closed (see HeapFile::recsRead).
+
+struct NodeStats
+{
+  double seconds;                       // wall time
+  long tuplesIn;                        // records read from heap files
+  long tuplesOut;                       // tuples returned by next()
+  int hits;                             // pages found in the buffer pool
+  int reads;                            // pages read from disk
+  int allocs;                           // new pages
+  int writes;                           // pages written to disk
+  int peakPinned;                       // most frames pinned at once
+};
+
+// The plan nodes a plan was run with, in the order they were first
+// opened, each with its depth in the tree (a node opened while another
+// one is being called is its input) and its figures.
+
+class Profile {
+ public:
+  // before and after a call of a node; entry is -1 for a node that has
+  // not been called yet. tuple is the tuple the call returned, if any.
+  void enter(int & entry);
+  void leave(const int entry, const Record *tuple);
+  void describe(const int entry, const string & what);
+
+  void print() const;
+
+ private:
+  struct Entry
+  {
+    string what;                        // describe() of the node
+    int depth;
+    NodeStats stats;
+  };
+
+  // a call in progress: the counters when it started
+  struct Call
+  {
+    struct timeval start;
+    BufStats bufStats;
+    long recsRead;
+  };
+
+  vector<Entry> entries;
+  vector<Call> calls;
+};
+
+
+// Scan of a heap file. The predicate "attr op filter" of a select is
+// checked by the scan itself; without attr every tuple comes out. On a
+// dictionary encoded attribute the filter is a string, which the scan
+// turns into the set of codes that satisfy the predicate.
+
+class ScanNode : public PlanNode {
+ public:
+  ScanNode(const string & relation, const AttrDesc *attr,
+	   const Operator op, const char *filter);
+  ~ScanNode();
+
+  string describe() const;
+
+ protected:
+  const Status doOpen();
+  const Status doNext(Record & rec);
+  const Status doClose();
+
+ private:
+  string relation;
+  AttrDesc attr;
+  bool filtered;                        // attr is set
+  Operator op;
+  const char *filter;
+  vector<bool> codes;                   // of filter, if attr is encoded
+  HeapFileScan *scan;
+};
+
+
+// The tuples whose attribute satisfies "attr op filter", found with
+// the index on attr: a hash index for EQ, a B+-tree for any operator
+// but NE. On a dictionary encoded attribute only EQ is looked up, with
+// the code of filter, a string.
+
+class IndexScanNode : public PlanNode {
+ public:
+  IndexScanNode(const AttrDesc & attr, const Operator op,
+		const char *filter);
+  ~IndexScanNode();
+
+  string describe() const;
+
+ protected:
+  const Status doOpen();
+  const Status doNext(Record & rec);
+  const Status doClose();
+
+ private:
+  AttrDesc attr;
+  Operator op;
+  const char *filter;
+  int code;                             // of filter, if attr is encoded
+  HeapFile *rel;
+  HashIndex *hashIndex;                 // one of these is open
+  BTreeIndex *btreeIndex;
+};
+
+
+// The projected attributes of each tuple of its input, one after the
+// other.
+
+class ProjectNode : public PlanNode {
+ public:
+  ProjectNode(PlanNode *input, const int projCnt, const AttrDesc projs[]);
+  ~ProjectNode();
+
+  string describe() const;
+
+ protected:
+  const Status doOpen();
+  const Status doNext(Record & rec);
+  const Status doClose();
+
+ private:
+  PlanNode *input;
+  vector<AttrDesc> projs;
+  vector<char> outputData;
+};
+
+
+// A relation sorted on one attribute with SortedFile. The sort is done
+// by open(), with runs as large as the frames that are free then
+// allow. keys and semiJoin are handed to SortedFile. The position of
+// the input can be marked and gone back to, for merging.
+
+class SortNode : public PlanNode {
+ public:
+  SortNode(const AttrDesc & attr, BloomFilter *keys = NULL,
+	   const BloomFilter *semiJoin = NULL);
+  ~SortNode();
+
+  string describe() const;
+
+  const Status setMark();
+  const Status gotoMark();
+
+ protected:
+  const Status doOpen();
+  const Status doNext(Record & rec);
+  const Status doClose();
+
+ private:
+  AttrDesc attr;
+  BloomFilter *keys;
+  const BloomFilter *semiJoin;
+  SortedFile *sorted;
+};
+
+
+// Runs a plan whose tuples are made of the projected attributes projs.
+// With an empty result name they are printed as they come, otherwise
+// they are inserted into the result relation. With analyze they are
+// only counted, and the figures of every node are printed instead.
+extern const Status ExecPlan(PlanNode *plan, const string & result,
+			     const int projCnt, const AttrDesc projs[],
+			     const bool analyze = false);
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include <vector>
+#include "catalog.h"
+
+
+// define if debug output wanted
+//#define DEBUGINDEX
+
+
+// The directory is kept in directory pages listed in the header page.
+// A directory page holds HI_DIRENTRIES bucket page numbers and the
+// header has room for HI_MAXDIRPAGES of them, which limits the global
+// depth to HI_MAXDEPTH (2^15 <= 248 * 256).
+#define HI_DIRENTRIES	((int) (PAGESIZE / sizeof(int)))
+#define HI_MAXDIRPAGES	((int) (PAGESIZE / sizeof(int)) - 8)
+#define HI_MAXDEPTH	15
+
+
+// Extendible hash index on one attribute of a relation, stored in a
+// file of its own (see fileName()). Each entry is the RID of a tuple
+// and its value of the attribute. The directory maps the low depth
+// bits of the hash of a value to a bucket page; a full bucket is
+// split in two on the next bit, doubling the directory when the
+// bucket already uses all depth bits. A bucket whose entries all have
+// the same hash value (duplicates) cannot be split; it grows a chain
+// of overflow pages instead. Deleting entries does not merge buckets.
+//
+// While the index is open its header page stays pinned and the
+// directory is held in memory; it is written back by the destructor.
+// A lookup therefore reads one bucket page, plus its overflow pages.
+
+class HashIndex {
+ public:
+  // open the index on attr of relation
+  HashIndex(const string & relation, const AttrDesc & attr, Status & status);
+  ~HashIndex();                         // write back directory, close
+
+  // create an empty index with at least numBuckets buckets
+  static const Status create(const string & relation, const AttrDesc & attr,
+			     const int numBuckets);
+  static const Status destroy(const string & relation,
+			      const string & attrName);
+  static const string fileName(const string & relation,
+			       const string & attrName);
+
+  // entries per bucket page for an attribute of attrLen bytes
+  static int bucketCapacity(const int attrLen);
+
+  const Status insertEntry(const char *key, const RID & rid);
+  const Status deleteEntry(const char *key, const RID & rid);
+
+  // RIDs of the entries with the given key; scanNext returns NOMORERECS
+  // after the last one
+  const Status startScan(const char *key);
+  const Status scanNext(RID & rid);
+  const Status endScan();
+
+  int getEntryCnt() const { return hdr->entryCnt; }
+  int getBucketCnt() const { return hdr->bucketCnt; }
+  int getOverflowCnt() const { return hdr->overflowCnt; }
+  int getDepth() const { return hdr->depth; }
+
+ private:
+  typedef struct {
+    int keyOffset;                      // attribute in the relation
+    int keyLen;
+    int keyType;
+    int depth;                          // global depth
+    int entryCnt;
+    int bucketCnt;                      // buckets, not counting overflow
+    int overflowCnt;                    // overflow pages
+    int dirPageCnt;
+    int dirPage[HI_MAXDIRPAGES];        // the directory pages, in order
+  } HDR;
+
+  // A bucket page, or one of its overflow pages. Entries are packed
+  // from the start of entries: the RID followed by the key.
+  typedef struct {
+    int depth;                          // local depth
+    int entryCnt;
+    int overflow;                       // next page of bucket, -1 if none
+    char entries[PAGESIZE - 3 * sizeof(int)];
+  } BUCKET;
+
+  unsigned int hash(const char *key) const;
+  bool keyEqual(const char *key1, const char *key2) const;
+  const Status readBucket(const int pageNo, BUCKET *&bucket);
+  const Status newBucket(const int depth, int & pageNo);
+  const Status addBuckets(const int depth);   // fill an empty directory
+  // add an entry to the bucket at pageNo, with a new overflow page if
+  // needed and grow is set; BUCKETFULL if not
+  const Status appendEntry(const int pageNo, const char *entry,
+			   const bool grow);
+  // local depth of the bucket at pageNo, and whether all its entries
+  // hash to h
+  const Status chainInfo(const int pageNo, const unsigned int h,
+			 int & depth, bool & same);
+  const Status split(const int b);      // split the bucket of dir[b]
+  const Status writeDir();
+
+  File *file;
+  int hdrPageNo;
+  HDR *hdr;                             // pinned header page
+  bool hdrDirty;
+  vector<int> dir;                      // the directory
+  bool dirDirty;
+  int entryLen;                         // bytes per entry
+  int capacity;                         // entries per bucket page
+
+  // state of the scan
+  char scanKey[MAXSTRINGLEN + 1];
+  int scanPageNo;
+  BUCKET *scanPage;                     // pinned, or NULL
+  int scanSlot;                         // next entry to look at
+};
+
+#endif
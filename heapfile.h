@@ -7,6 +7,7 @@
 #include <vector>
 #include <string.h>
 #include <assert.h>
+#include <atomic>
 #include "stdlib.h"
 using namespace std;
 
@@ -15,6 +16,8 @@ using namespace std;
 
 extern DB db;
 
+class BloomFilter;
+
 // define if debug output wanted
 //#define DEBUGREL
 
@@ -34,6 +37,11 @@ struct FileHdrPage
 };
 
 
+// prevPageNo of a scan that was moved to another page by resetScan:
+// the page before it is looked up when it is needed
+#define HFS_PREVUNKNOWN -2
+
+
 // class definition of heapFile
 class HeapFile {
 protected:
@@ -46,6 +54,12 @@ protected:
    int   	curPageNo;	// page number of pinned page
    bool  	curDirtyFlag;   // true if page has been updated
    RID   	curRec;         // rid of last record returned
+   int		readCnt;	// records read, added to recsRead on close
+
+   // set the dirty flag of the current or the header page and mark its
+   // frame dirty at once, so that a commit logs it while it is pinned
+   void curChanged();
+   void hdrChanged();
 
 public:
 
@@ -58,8 +72,15 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in file
+  const int getPageCnt() const;
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
+
+  // records read by heap files that have been closed: fetched by RID,
+  // or looked at by a scan whether or not they satisfied it
+  static atomic<long> recsRead;
 };
 
 
@@ -78,9 +99,19 @@ public:
                            const char* filter, 
                            const Operator op);
 
+    // also drop records whose attribute at offset is not in bloom
+    // (semi-join); NULL turns it off again
+    const Status setSemiJoin(const int offset, const BloomFilter* bloom);
+
+    // also drop records whose attribute at offset, a dictionary code
+    // (see dict.h), is not set in codes; NULL turns it off again
+    const Status setCodeSet(const int offset, const vector<bool>* codes);
+
     const Status endScan(); // terminate the scan
     const Status markScan(); // save current position of scan
     const Status resetScan(); // reset scan to last marked location
+    // continue the scan after rid, a record of this file
+    const Status positionScan(const RID & rid);
 
     // return RID of next record that satisfies the scan 
     const Status scanNext(RID& outRid);
@@ -91,6 +122,12 @@ public:
     // delete current record 
     const Status deleteRecord();
 
+    // delete current record later: the records deleted on a page go
+    // together, with one compaction, when the scan leaves the page or
+    // ends, and a page left empty is dropped from the file. Records
+    // stay readable until then. Not to be mixed with deleteRecord().
+    const Status deferDelete();
+
     // marks current page of scan dirty
     const Status markDirty();
 
@@ -100,6 +137,10 @@ private:
     Datatype type;           // datatype of filter attribute
     const char* filter;      // comparison value of filter
     Operator op;             // comparison operator of filter
+    int   semiOffset;        // byte offset of semi-join attribute
+    const BloomFilter* semiJoin; // semi-join filter, if any
+    int   codeOffset;        // byte offset of the coded attribute
+    const vector<bool>* codeSet; // codes that pass, if any
 
      // The following variables are used to preserve the state
     // of the scan when the method markScan() is invoked.
@@ -108,7 +149,19 @@ private:
     int   markedPageNo;	// page number of pinned page
     RID   markedRec;         // rid of last record returned
 
+    vector<RID> deferred;    // records of the current page to delete
+    int   prevPageNo;        // page before the current one, -1 if none,
+                             // HFS_PREVUNKNOWN after a reset
+
     const bool matchRec(const Record & rec) const;
+    // delete the deferred records of the current page
+    const Status deleteDeferred(bool & emptied);
+    // unlink the current page, which is empty, from the file and
+    // dispose of it; nextPageNo is the page after it
+    const Status releasePage(const int nextPageNo);
+    // do the deferred deletes of the current page and unpin it, or
+    // release it if they emptied it
+    const Status leavePage(bool & released);
 };
 
 
@@ -123,6 +176,12 @@ public:
 
     // insert record into file, returning its RID
     const Status insertRecord(const Record & rec, RID& outRid); 
+
+    // append page, whose recCnt records were inserted into it away from
+    // the file, as the last page, returning its page number; an empty
+    // last page is taken over
+    const Status appendPage(const Page & page, const int recCnt,
+			    int & pageNo);
 };
 
 #endif
@@ -0,0 +1,35 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include <vector>
+#include "hashindex.h"
+#include "btree.h"
+
+
+// The indexes on the attributes of a relation, hash indexes and
+// B+-trees, opened together so that inserts and deletes can keep all
+// of them up to date.
+
+class IndexSet {
+ public:
+  IndexSet(const string & relation, const int attrCnt,
+	   const AttrDesc attrs[], Status & status);
+  ~IndexSet();
+
+  bool empty() const { return indexes.empty(); }
+
+  // add or remove the entries of the tuple rec stored at rid
+  const Status insertEntries(const Record & rec, const RID & rid);
+  const Status deleteEntries(const Record & rec, const RID & rid);
+
+ private:
+  typedef struct {
+    HashIndex *hash;                    // one of these is set
+    BTreeIndex *btree;
+    int offset;                         // of the indexed attribute
+  } INDEX;
+
+  vector<INDEX> indexes;
+};
+
+#endif
@@ -1,40 +1,64 @@
 
+// Hash table on the join attribute of the build relation of a hash
+// join. Entries live in one array and are chained through array
+// indices, so inserting a tuple does not allocate (the arrays grow by
+// doubling). Join attribute values are copied into a parallel key
+// array of keyLen bytes per entry. The two join attributes may be
+// strings of different lengths; keyLen is then the shorter one, and
+// only that many bytes of a value are hashed and compared.
+
 class joinHashTbl
 {
-private:
-    union JAttrType
-    {
-	int iValue;
-	float fValue;
-	char* sValue;
-    };
-	
-    struct joinhashBucket
+public:
+    // state of a probe: the matches of one key are returned one at a
+    // time by next() without allocating anything
+    struct Probe
     {
-	union JAttrType	attrValue;
-       	RID	rid;
-       	joinhashBucket*     next;    // next node in the hash table
+	const char*	key;	// join attribute value being probed
+	unsigned int	hash;	// its hash value
+	int		cur;	// next entry to look at, -1 at end of chain
     };
 
+private:
     struct HTentry
     {
-	int bucketCnt;  // nuumber of buckets on this chain
-	joinhashBucket*   chain;  // pointer to first bucket on the chain
+	unsigned int	hash;	// full hash value of the key
+	int		next;	// next entry on the chain, -1 at end
+	RID		rid;	// RID of the build tuple
     };
 
     AttrDesc 	joinAttr;
-    int 	HTSIZE;
-    HTentry 	*ht; // actual hash table
-    int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
+    int		mask;		// number of chains - 1 (a power of 2)
+    int		*heads;		// first entry of each chain, -1 if empty
+    HTentry	*entries;	// all entries, in insertion order
+    int		keyLen;		// bytes of a value hashed and compared
+    char	*keys;		// keyLen bytes of key per entry
+    int		entryCnt;	// entries in use
+    int		entryMax;	// entries allocated
+
+    // compare the key of entry i with a join attribute value
+    bool keyMatch(const int i, const char* attrPtr) const;
+
+    // double the number of chains and rechain all entries, newest
+    // first on each chain as insert leaves them
+    void rehash();
 
 public:
-    joinHashTbl(const int size, const AttrDesc attr);  // constructor
+    joinHashTbl(const int size, const AttrDesc attr,   // constructor
+		const int keyLen);
     ~joinHashTbl();
 
+     // hash a join attribute value; STRING values end at the first null
+     static unsigned int hash(const char* attrPtr, const int attrType,
+                              const int attrLen);
+
      // insert a new (JoinAttrValue, RID) pair into hash table
      Status insert(const RID newRid,  const char* tuple);
 
-     // get RIDs of records whose join attribute value matches innerJoinAttrValue
-     Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
-};
+     // start looking for records whose join attribute value matches
+     // innerJoinAttrPtr; the value must stay valid while probing
+     void lookup(const char* innerJoinAttrPtr, Probe & probe) const;
 
+     // RID of the next match; HASHNOTFOUND when there are no more
+     Status next(Probe & probe, RID & outRid) const;
+};
@@ -51,6 +51,9 @@ public:
 
     const Status getNextPage(int& pageNo) const; // returns value of nextPage
     const Status setNextPage(const int pageNo); // sets value of nextPage to pageNo
+    // sets the page number of a page built away from its file, which
+    // the RIDs of its records take
+    const Status setPageNo(const int pageNo);
     const short getFreeSpace() const; // returns amount of free space
 
     // inserts a new record (rec) into the page, returns RID of record 
@@ -59,6 +62,9 @@ public:
     // delete the record with the specified rid
     const Status deleteRecord(const RID & rid);
 
+    // delete the cnt records with the specified rids with one compaction
+    const Status deleteRecords(const RID rids[], const int cnt);
+
     // returns RID of first record on page
     // returns  NORECORDS if page contains no records.  Otherwise, returns OK
     const Status firstRecord(RID& firstRid) const;
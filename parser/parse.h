@@ -11,6 +11,7 @@ typedef struct {
   char *attrName;                       // relation name
   int attrType;                         // type of attribute
   int attrLen;                          // length of attribute
+  int dictionary;                       // string is dictionary encoded
 } ATTR_DESCR;
 
 
@@ -57,6 +58,7 @@ typedef enum {
     N_LOAD,
     N_PRINT,
     N_HELP,
+    N_ANALYZE,
     N_SELECT,
     N_JOIN,
     N_PRIMATTR,
@@ -82,6 +84,8 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *qual;
+	    int explain;		// an ExplainMode: 1 prints the plan,
+					// 2 also runs it (EXPLAIN ANALYZE)
 	} QUERY;
 
 	// insert node */
@@ -113,6 +117,7 @@ typedef struct node {
 	    char *relname;
 	    char *attrname;
 	    int nbuckets;
+	    int btree;			// B+-tree rather than hash index
 	} BUILD;
 
 	// drop node */
@@ -125,6 +130,7 @@ typedef struct node {
 	struct {
 	    char *relname;
 	    char *filename;
+	    char *delimiter;		// of a text file, NULL if binary
 	} LOAD;
 
 	// pprint node */
@@ -137,6 +143,11 @@ typedef struct node {
 	    char *relname;
 	} HELP;
 
+	// analyze node */
+	struct {
+	    char *relname;
+	} ANALYZE;
+
 	// select node */
 	struct {
 	    struct node *selattr;
@@ -177,6 +188,7 @@ typedef struct node {
 	    // 'i'-128 means integer
 	    // 'f'-128 means real
 	    // otherwise means length of string
+	    int  dictionary;		// string is dictionary encoded
 
 	   // char *type;
 	} ATTRTYPE;
@@ -217,19 +229,21 @@ NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
 NODE *destroy_node(char *relname);
-NODE *build_node(char *relname, char *attrname, int nbuckets);
-NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
+NODE *build_node(char *relname, char *attrname, int nbuckets, int btree);
+NODE *rebuild_node(char *relname, char *attrname, int nbuckets, int btree);
 NODE *drop_node(char *relname, char *attrname);
-NODE *load_node(char *relname, char *filename);
+NODE *load_node(char *relname, char *filename, char *delimiter);
 NODE *print_node(char *relname);
 NODE *help_node(char *relname);
+NODE *analyze_node(char *relname);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
 NODE *qualattr_node(char *relname, char *attrname);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
 //attrtype_node need to change due to change of NODE.ATTRTYPE
-NODE *attrtype_node(char *attrname, int type /*char *type*/);
+NODE *attrtype_node(char *attrname, int type /*char *type*/,
+		    int dictionary);
 NODE *int_node(int ival);
 NODE *float_node(float rval);
 NODE *string_node(char *s);
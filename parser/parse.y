@@ -18,6 +18,9 @@ void yyerror(char *);
 
 extern char *yytext;                    // tokens in string format
 static NODE *parse_tree;                // root of parse tree
+static int session;                     // reading a session's statements
+static int session_end;                 // the session's input ended
+static int session_quit;                // the session asked to quit
 %}
 
 %union{
@@ -35,6 +38,8 @@ static NODE *parse_tree;                // root of parse tree
 		RW_PRINT
 		RW_LOAD
 		RW_HELP
+		RW_ANALYZE
+		RW_EXPLAIN
 		RW_QUIT
 		RW_SELECT
 		RW_INTO
@@ -43,6 +48,9 @@ static NODE *parse_tree;                // root of parse tree
 		RW_DELETE
 		RW_PRIMARY
 		RW_NUMBUCKETS
+		RW_BTREE
+		RW_DELIMITED
+		RW_DICTIONARY
 		RW_ALL
 		RW_FROM
 		RW_AS
@@ -85,13 +93,13 @@ static NODE *parse_tree;                // root of parse tree
 		create
 		destroy
 		build
-/*
 		rebuild
-*/
 		drop
 		load
 		print
 		help
+		analyze
+		explain
 		quit
 		opt_primary_attr
 		opt_where
@@ -125,7 +133,10 @@ start
 	{
 	        if(!isatty(0))
 		    puts($1);
-		(void)system($1);
+		if (session)
+		    puts("shell commands are not allowed in a session");
+		else
+		    (void)system($1);
 		parse_tree = NULL;
 		YYACCEPT;
 	}
@@ -137,6 +148,11 @@ start
 	}
 	| T_EOF
 	{
+		if (session) {
+		    session_end = 1;
+		    parse_tree = NULL;
+		    YYACCEPT;
+		}
 		quit();
 	}
 	;
@@ -148,13 +164,13 @@ command
 	| create
 	| destroy
 	| build
-/*
 	| rebuild
-*/
 	| drop
 	| load
 	| print
 	| help
+	| analyze
+	| explain
 	| quit
 	| nothing
 	{
@@ -272,18 +288,24 @@ destroy
 build
 	: RW_BUILD string '(' string ')'
 	{
-		$$ = build_node($2, $4, 0);
+		$$ = build_node($2, $4, 0, 0);
+	}
+	| RW_BUILD string '(' string ')' RW_BTREE
+	{
+		$$ = build_node($2, $4, 0, 1);
 	}
 	;
 
-/*
 rebuild
 	: RW_REBUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
 	{
-		$$ = rebuild_node($2, $4, $8);
+		$$ = rebuild_node($2, $4, $8, 0);
+	}
+	| RW_REBUILD string '(' string ')' RW_BTREE
+	{
+		$$ = rebuild_node($2, $4, 0, 1);
 	}
 	;
-*/
 
 drop
 	: RW_DROP string '(' string ')'
@@ -299,7 +321,16 @@ drop
 load
 	: RW_LOAD RW_TABLE string RW_FROM '(' T_QSTRING ')'
 	{
-		$$ = load_node($3, $6);
+		$$ = load_node($3, $6, NULL);
+	}
+	| RW_LOAD RW_TABLE string RW_FROM '(' T_QSTRING ')' RW_DELIMITED
+	{
+		$$ = load_node($3, $6, (char *) ",");
+	}
+	| RW_LOAD RW_TABLE string RW_FROM '(' T_QSTRING ')' RW_DELIMITED
+	  T_QSTRING
+	{
+		$$ = load_node($3, $6, $9);
 	}
 	;
 print
@@ -316,9 +347,36 @@ help
 	}
 	;
 
+analyze
+	: RW_ANALYZE opt_relname
+	{
+		$$ = analyze_node($2);
+	}
+	;
+
+explain
+	: RW_EXPLAIN query
+	{
+		$$ = $2;
+		if ($$ != NULL)
+		  $$->u.QUERY.explain = 1;
+	}
+	| RW_EXPLAIN RW_ANALYZE query
+	{
+		$$ = $3;
+		if ($$ != NULL)
+		  $$->u.QUERY.explain = 2;
+	}
+	;
+
 quit
 	: RW_QUIT ';'
 	{
+		if (session) {
+		    session_end = session_quit = 1;
+		    parse_tree = NULL;
+		    YYACCEPT;
+		}
 		quit();
 	}
 	;
@@ -444,19 +502,23 @@ non_mt_attrtype_list
 attrtype
 	: string INT_TYPE
  	{
-		$$ = attrtype_node($1, 'i'-128);
+		$$ = attrtype_node($1, 'i'-128, 0);
 	}
 	| string REAL_TYPE
 	{
-		$$ = attrtype_node($1, 'f'-128);
+		$$ = attrtype_node($1, 'f'-128, 0);
 	}
 	| string CHAR_TYPE '(' value ')'
 	{
-	 	$$ = attrtype_node($1, $4->u.VALUE.u.ival);
+	 	$$ = attrtype_node($1, $4->u.VALUE.u.ival, 0);
+	}
+	| string CHAR_TYPE '(' value ')' RW_DICTIONARY
+	{
+	 	$$ = attrtype_node($1, $4->u.VALUE.u.ival, 1);
 	}
 	| string CHAR_TYPE
 	{
-		$$ = attrtype_node($1, 2);
+		$$ = attrtype_node($1, 2, 0);
 	}
 	;
 
@@ -519,6 +581,7 @@ void parse(void)
 {
   extern void new_query();
   extern void interp(NODE *);
+  extern void UT_Commit();
 
   for(;;){
 
@@ -529,10 +592,49 @@ void parse(void)
     printf("%s", PROMPT);
     fflush(stdout);
 
-    // if a query was successfully read, interpret it
-    if(yyparse() == 0 && parse_tree != NULL)
+    // if a query was successfully read, interpret it and commit it; a
+    // batch of inserts commits as a whole when it ends (QU_EndInsert)
+    if(yyparse() == 0 && parse_tree != NULL) {
+      bool insert = (parse_tree->kind == N_INSERT);
+      interp(parse_tree);
+      if (!insert)
+	UT_Commit();
+    }
+  }
+}
+
+
+//
+// parse_session: interprets the statements of a session of the server
+// that are in the file in, as parse() does, except that the end of the
+// input and quit end the session rather than minirel, that shell
+// commands are refused, and that inserts commit one by one, since the
+// session gets its reply only once its statement is durable.
+//
+// Returns 1 if the session quit, 0 otherwise.
+//
+
+int parse_session(FILE *in)
+{
+  extern void new_query();
+  extern void interp(NODE *);
+  extern void UT_Commit();
+  extern void yyrestart(FILE *);
+
+  session = 1;
+  session_end = session_quit = 0;
+  yyrestart(in);
+
+  while (!session_end) {
+    new_query();
+    if(yyparse() == 0 && parse_tree != NULL) {
       interp(parse_tree);
+      UT_Commit();
+    }
   }
+
+  session = 0;
+  return session_quit;
 }
 
 
@@ -62,38 +62,43 @@ extern int yydebug;
     RW_PRINT = 263,                /* RW_PRINT  */
     RW_LOAD = 264,                 /* RW_LOAD  */
     RW_HELP = 265,                 /* RW_HELP  */
-    RW_QUIT = 266,                 /* RW_QUIT  */
-    RW_SELECT = 267,               /* RW_SELECT  */
-    RW_INTO = 268,                 /* RW_INTO  */
-    RW_WHERE = 269,                /* RW_WHERE  */
-    RW_INSERT = 270,               /* RW_INSERT  */
-    RW_DELETE = 271,               /* RW_DELETE  */
-    RW_PRIMARY = 272,              /* RW_PRIMARY  */
-    RW_NUMBUCKETS = 273,           /* RW_NUMBUCKETS  */
-    RW_ALL = 274,                  /* RW_ALL  */
-    RW_FROM = 275,                 /* RW_FROM  */
-    RW_AS = 276,                   /* RW_AS  */
-    RW_TABLE = 277,                /* RW_TABLE  */
-    RW_AND = 278,                  /* RW_AND  */
-    RW_OR = 279,                   /* RW_OR  */
-    RW_NOT = 280,                  /* RW_NOT  */
-    RW_VALUES = 281,               /* RW_VALUES  */
-    INT_TYPE = 282,                /* INT_TYPE  */
-    REAL_TYPE = 283,               /* REAL_TYPE  */
-    CHAR_TYPE = 284,               /* CHAR_TYPE  */
-    T_EQ = 285,                    /* T_EQ  */
-    T_LT = 286,                    /* T_LT  */
-    T_LE = 287,                    /* T_LE  */
-    T_GT = 288,                    /* T_GT  */
-    T_GE = 289,                    /* T_GE  */
-    T_NE = 290,                    /* T_NE  */
-    T_EOF = 291,                   /* T_EOF  */
-    NOTOKEN = 292,                 /* NOTOKEN  */
-    T_INT = 293,                   /* T_INT  */
-    T_REAL = 294,                  /* T_REAL  */
-    T_STRING = 295,                /* T_STRING  */
-    T_QSTRING = 296,               /* T_QSTRING  */
-    T_SHELL_CMD = 297              /* T_SHELL_CMD  */
+    RW_ANALYZE = 266,              /* RW_ANALYZE  */
+    RW_EXPLAIN = 267,              /* RW_EXPLAIN  */
+    RW_QUIT = 268,                 /* RW_QUIT  */
+    RW_SELECT = 269,               /* RW_SELECT  */
+    RW_INTO = 270,                 /* RW_INTO  */
+    RW_WHERE = 271,                /* RW_WHERE  */
+    RW_INSERT = 272,               /* RW_INSERT  */
+    RW_DELETE = 273,               /* RW_DELETE  */
+    RW_PRIMARY = 274,              /* RW_PRIMARY  */
+    RW_NUMBUCKETS = 275,           /* RW_NUMBUCKETS  */
+    RW_BTREE = 276,                /* RW_BTREE  */
+    RW_DELIMITED = 277,            /* RW_DELIMITED  */
+    RW_DICTIONARY = 278,           /* RW_DICTIONARY  */
+    RW_ALL = 279,                  /* RW_ALL  */
+    RW_FROM = 280,                 /* RW_FROM  */
+    RW_AS = 281,                   /* RW_AS  */
+    RW_TABLE = 282,                /* RW_TABLE  */
+    RW_AND = 283,                  /* RW_AND  */
+    RW_OR = 284,                   /* RW_OR  */
+    RW_NOT = 285,                  /* RW_NOT  */
+    RW_VALUES = 286,               /* RW_VALUES  */
+    INT_TYPE = 287,                /* INT_TYPE  */
+    REAL_TYPE = 288,               /* REAL_TYPE  */
+    CHAR_TYPE = 289,               /* CHAR_TYPE  */
+    T_EQ = 290,                    /* T_EQ  */
+    T_LT = 291,                    /* T_LT  */
+    T_LE = 292,                    /* T_LE  */
+    T_GT = 293,                    /* T_GT  */
+    T_GE = 294,                    /* T_GE  */
+    T_NE = 295,                    /* T_NE  */
+    T_EOF = 296,                   /* T_EOF  */
+    NOTOKEN = 297,                 /* NOTOKEN  */
+    T_INT = 298,                   /* T_INT  */
+    T_REAL = 299,                  /* T_REAL  */
+    T_STRING = 300,                /* T_STRING  */
+    T_QSTRING = 301,               /* T_QSTRING  */
+    T_SHELL_CMD = 302              /* T_SHELL_CMD  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -110,51 +115,56 @@ extern int yydebug;
 #define RW_PRINT 263
 #define RW_LOAD 264
 #define RW_HELP 265
-#define RW_QUIT 266
-#define RW_SELECT 267
-#define RW_INTO 268
-#define RW_WHERE 269
-#define RW_INSERT 270
-#define RW_DELETE 271
-#define RW_PRIMARY 272
-#define RW_NUMBUCKETS 273
-#define RW_ALL 274
-#define RW_FROM 275
-#define RW_AS 276
-#define RW_TABLE 277
-#define RW_AND 278
-#define RW_OR 279
-#define RW_NOT 280
-#define RW_VALUES 281
-#define INT_TYPE 282
-#define REAL_TYPE 283
-#define CHAR_TYPE 284
-#define T_EQ 285
-#define T_LT 286
-#define T_LE 287
-#define T_GT 288
-#define T_GE 289
-#define T_NE 290
-#define T_EOF 291
-#define NOTOKEN 292
-#define T_INT 293
-#define T_REAL 294
-#define T_STRING 295
-#define T_QSTRING 296
-#define T_SHELL_CMD 297
+#define RW_ANALYZE 266
+#define RW_EXPLAIN 267
+#define RW_QUIT 268
+#define RW_SELECT 269
+#define RW_INTO 270
+#define RW_WHERE 271
+#define RW_INSERT 272
+#define RW_DELETE 273
+#define RW_PRIMARY 274
+#define RW_NUMBUCKETS 275
+#define RW_BTREE 276
+#define RW_DELIMITED 277
+#define RW_DICTIONARY 278
+#define RW_ALL 279
+#define RW_FROM 280
+#define RW_AS 281
+#define RW_TABLE 282
+#define RW_AND 283
+#define RW_OR 284
+#define RW_NOT 285
+#define RW_VALUES 286
+#define INT_TYPE 287
+#define REAL_TYPE 288
+#define CHAR_TYPE 289
+#define T_EQ 290
+#define T_LT 291
+#define T_LE 292
+#define T_GT 293
+#define T_GE 294
+#define T_NE 295
+#define T_EOF 296
+#define NOTOKEN 297
+#define T_INT 298
+#define T_REAL 299
+#define T_STRING 300
+#define T_QSTRING 301
+#define T_SHELL_CMD 302
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 23 "parse.y"
+#line 26 "parse.y"
 
   int ival;
   float rval;
   char *sval;
   NODE *n;
 
-#line 158 "y.tab.h"
+#line 168 "y.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -1,6 +1,7 @@
 #ifndef PARTITION_H
 #define PARTITION_H
 
+#include <vector>
 #include "heapfile.h"
 
 
@@ -8,21 +9,74 @@
 //#define DEBUGPART
 
 
+// Bytes of records buffered in memory for a partition before they
+// are appended to its file.
+#define PART_BUFSIZE	(4 * PAGESIZE)
+
+// How often an oversized partition may be split again.
+#define PART_MAXLEVEL	4
+
+
 class Partition {
  public:
   Partition(HeapFileScan *rel,              // name of heap file to partition
 	    const string & fileName,             // (base) name of heap file
 	    const int P,                      // number of partitions
 	    const int (*hashfcn)(const Record & rec,
-				 const int P),  
+				 const int P,
+				 const int level),
 	                               // hash function to use in partitioning
 	    string* &partName,           // names of partitioned heap files
-	    Status &status);            // create partitions of file
+	    Status &status,             // create partitions of file
+	    const Status (*resident)(const Record & rec,
+				     void *arg) = NULL,
+	                               // if given, consumes partition 0
+	    void *residentArg = NULL,   // passed through to resident
+	    const int maxBytes = 0,     // split partitions larger than this
+	    const Partition *shape = NULL); // if given, partition like it
   ~Partition();                         // destroy partitions
 
+  int getPartCnt() const { return leaves.size(); } // # of partition files
+  int getRecCnt(const int p) const;     // records in partition p
+  int getByteCnt(const int p) const;    // bytes of records in partition p
+  void printHistogram() const;          // print the partition sizes
+
+  // directory for the partition files; "/tmp/" unless set
+  static const string & getTempDir();
+  static void setTempDir(const string & dir);
+
  private:
 
+  // A partition that has been split again has fanout children, which
+  // are partitioned with the hash function at the next level.
+  typedef struct {
+    string name;                        // partition file, empty if none
+    int level;                          // 0 for the first P partitions
+    int child;                          // first child, -1 if not split
+    int fanout;                         // # of children
+    bool splittable;                    // splitting it again may help
+    int recCnt;                         // records in partition
+    int byteCnt;                        // bytes of records in partition
+    char *buf;                          // records not written out yet
+    int used;                           // bytes used in buf
+  } PART;
+
+  Status route(const Record & rec);     // put rec in its partition
+  Status add(PART & part, const Record & rec);  // buffer rec for part
+  Status flush(PART & part);            // write out buffered records
+  Status split(const int n);            // split partition n again
+  int findPart(const Record & rec) const; // partition that rec goes to
+  Status makeFiles(const int first);    // create files of parts[first..]
+
+  const int (*hashfcn)(const Record & rec, const int P, const int level);
+  const Status (*resident)(const Record & rec, void *arg);
+  void *residentArg;
+  int maxBytes;                         // split partitions larger
+
   int P;                                // number of partitions
+  vector<PART> parts;                   // all partitions, the first P
+                                        // first, then children
+  vector<int> leaves;                   // partitions that were not split
   string *partName;                      // partition names
 };
 
@@ -3,7 +3,14 @@
 
 #include "heapfile.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+// The join method given on the command line; CostBasedJoin leaves the
+// choice to the cost model for each join.
+enum JoinType {NLJoin, SMJoin, HashJoin, RadixHashJoin, CostBasedJoin};
+
+// EXPLAIN prints the plan of a query instead of running it; EXPLAIN
+// ANALYZE prints the plan, runs it and prints what each operator of
+// it did instead of the tuples.
+enum ExplainMode {NoExplain, ExplainPlan, ExplainAnalyze};
 
 //
 // Prototypes for query layer functions
@@ -15,18 +22,21 @@ const Status QU_Select(const string & result,
 		       const attrInfo projNames[],
 		       const attrInfo *attr, 
 		       const Operator op, 
-		       const char *attrValue);
+		       const char *attrValue,
+		       const ExplainMode explain);
 
 const Status QU_Join(const string & result, 
 		     const int projCnt, 
 		     const attrInfo projNames[],
 		     const attrInfo *attr1, 
 		     const Operator op, 
-		     const attrInfo *attr2);
+		     const attrInfo *attr2,
+		     const ExplainMode explain);
 
 const Status QU_Insert(const string & relation, 
 		       const int attrCnt, 
 		       const attrInfo attrList[]);
+const Status QU_EndInsert();
 
 const Status QU_Delete(const string & relation, 
 		       const string & attrName, 
@@ -0,0 +1,121 @@
+#ifndef RADIXJOIN_H
+#define RADIXJOIN_H
+
+#include <vector>
+#include "catalog.h"
+
+// define if debug output wanted
+//#define DEBUGRADIX
+
+// Build partitions are made small enough for themselves and their
+// hash table to fit in a cache of this many bytes (a typical L2).
+#define RJ_CACHESIZE	(256 * 1024)
+
+// Radix bits used in one partitioning pass: a pass writes to at most
+// 2^RJ_PASSBITS partitions at once, few enough that the cache and the
+// TLB keep up with the writes.
+#define RJ_PASSBITS	7
+
+
+// Parallel radix-partitioned equi-join in main memory. The tuples of
+// both relations are copied into memory together with the hash value
+// of their join attribute. Both sides are then partitioned on the low
+// bits of the hash, in as many passes as it takes for each build
+// partition to fit in the cache. All threads take part in the first
+// pass, each on a slice of the input. The partitions it produces are
+// tasks, dealt out to the queues of the workers: a worker partitions
+// its task further and then joins each resulting pair of partitions
+// with a small hash table. A worker whose queue runs dry steals
+// tasks from the other end of the other queues.
+//
+// Matching pairs are handed to a callback along with the number of
+// the worker that found them, so each worker can keep its own output.
+
+class RadixJoin
+{
+public:
+    // called for every matching pair, concurrently by the workers
+    typedef const Status (*Emit)(const int worker, const Record & buildRec,
+				 const Record & probeRec, void *arg);
+
+    RadixJoin(const AttrDesc & buildAttr, const AttrDesc & probeAttr,
+	      const int threads);
+    ~RadixJoin();
+
+    Status addBuild(const Record & rec);	// copy a build tuple
+    Status addProbe(const Record & rec);	// copy a probe tuple
+
+    // join all tuples added so far, calling emit for each match
+    Status join(Emit emit, void *arg);
+
+    int getPartCnt() const { return 1 << bits; }   // final partitions
+    int getPassCnt() const { return passCnt; }     // partitioning passes
+    int getStealCnt() const { return stealCnt; }   // tasks stolen
+
+private:
+    struct Item
+    {
+	unsigned int	hash;	// hash value of the join attribute
+	int		tuple;	// offset of the tuple in the arena
+    };
+
+    // the tuples of one relation; in the arena each tuple is its
+    // length followed by its bytes
+    struct Side
+    {
+	char	*arena;
+	int	used;		// bytes used in arena
+	int	size;		// bytes allocated for arena
+	Item	*items;		// one per tuple
+	Item	*tmp;		// target of partitioning passes
+	int	cnt;		// tuples
+	int	max;		// items allocated
+	int	offset;		// offset of the join attribute
+	int	*start;		// first item of each partition of the
+				// first pass, and the end
+    };
+
+    Status add(Side & side, const Record & rec);
+    Record tuple(const Side & side, const Item & item) const;
+    bool keyEqual(const char *key1, const char *key2) const;
+
+    // first pass, run by all threads on slices of side
+    void firstPass(Side & side, const int shift, const int passBits);
+
+    // task of worker w: partition the pair of ranges further, then
+    // join every pair of partitions
+    Status joinRange(const int w, Item *build, Item *buildTo,
+		     const int bLo, const int bHi,
+		     Item *probe, Item *probeTo,
+		     const int pLo, const int pHi,
+		     const int shift, const int bitsLeft);
+
+    // scatter from[lo..hi-1] into to[] on passBits bits of the hash
+    // at shift; bound gets the 2^passBits + 1 partition boundaries
+    static void scatter(const Item *from, Item *to, const int lo,
+			const int hi, const int shift, const int passBits,
+			std::vector<int> & bound);
+
+    // join one pair of final partitions with a hash table
+    Status buildProbe(const int w, const Item *build, const int bCnt,
+		      const Item *probe, const int pCnt);
+
+    Side	buildSide;
+    Side	probeSide;
+    Datatype	type;		// of the join attributes
+    int		length;		// bytes of a join attribute value hashed
+				// and compared, the shorter of the two
+    int		threads;
+    int		bits;		// radix bits in all passes
+    int		passCnt;
+    int		stealCnt;
+
+    Emit	emit;
+    void	*emitArg;
+
+    // hash table of each worker, reused for all its partitions
+    std::vector< std::vector<int> > heads;
+    std::vector< std::vector<int> > next;
+};
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include "error.h"
+#include <string>
+using namespace std;
+
+
+// Server mode of minirel: clients connect to a Unix domain socket and
+// each connection is a session. A client sends statements as it would
+// type them; for each one it gets back what minirel prints for it,
+// followed by a null byte. quit ends the session, and shell commands
+// are refused.
+//
+// Statements do not run concurrently: the parser and the query layer
+// keep their state in globals and print to the standard output, so
+// the statements of all sessions run one at a time, under a latch,
+// over the one buffer pool, log and catalog cache of the server.
+// Sessions are served by a pool of threads. A thread reads and frames
+// the statements of a session, sends their output and waits for the
+// log sync of their commits outside the latch, so that the commits of
+// the sessions share their syncs (see LogMgr::syncDeferred); that is
+// all the threads do at once. A session holds a thread for one
+// statement at a time; in between, the server polls it for its next
+// one, so there may be more sessions than threads.
+
+// serve sessions on socketName with threads threads, until SIGINT or
+// SIGTERM; then minirel quits (UT_Quit)
+const Status SV_Serve(const string & socketName, const int threads);
+
+#endif
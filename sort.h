@@ -1,61 +1,134 @@
 #ifndef SORT_H
 #define SORT_H
 
+#include <mutex>
 #include "heapfile.h"
+#include "bloom.h"
 
 // define if debug output wanted
 //#define DEBUGSORT
 
 
-// SORTREC is an in-memory sort record that qsort(3) sorts.
-// The sort attribute as well as the associated RID are
-// stored in the record. The RID is used for fetching the
-// full record when it is needed.
+// SORTREC is an in-memory sort record. Whole records are copied
+// into the arena of the SortedFile; a SORTREC points at one and
+// holds its sort attribute normalized into an unsigned integer whose
+// order is the order of the attribute (for strings only the first 8
+// bytes, ties are broken by comparing the attribute itself).
 
 typedef struct {
-  RID rid;                              // record id of current record
-  char* field;                          // pointer to field
-  int length;                           // length of field
+  unsigned long long key;               // normalized sort attribute
+  char* data;                           // record in the arena
+  int length;                           // length of record
+  int run;                              // run (replacement selection)
 } SORTREC;
 
 
+// How runs are generated. LOADSORT fills memory with maxItems records,
+// sorts them and writes them out as one run. REPLSELECT uses
+// replacement selection, which gives runs of about 2 * maxItems
+// records on random input and fewer, longer runs on input that is
+// nearly sorted already.
+
+enum RunStrategy { LOADSORT, REPLSELECT };
+
+
+// With workers > 1 the sort runs in parallel threads. The workers
+// take turns copying the next maxItems / workers records of the
+// source file (consecutive pages) into their own arenas, then sort
+// them and write their runs concurrently. The runs are then merged
+// in parallel as well: splitter keys sampled from the runs divide
+// the key range into one range per worker, and each worker merges
+// its range of every run into a run of its own. next() merges those
+// like any other runs. Only LOADSORT can be run in parallel.
+
+
 class SortedFile {
  public:
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int maxItems, Status& status,
+	     BloomFilter* keys = NULL,  // if given, gets every sort key
+	     const BloomFilter* semiJoin = NULL, // if given, drops
+	                                // records whose key is not in it
+	     RunStrategy strategy = LOADSORT,
+	     int workers = 1);          // # of threads to sort with
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
   Status gotoMark();                    // go to last recorded spot
   ~SortedFile();                        // destroy temporary structures / files
 
+  int getRunCnt() const { return runCnt; }   // runs generated
+  int getPassCnt() const { return passCnt; } // intermediate merge passes
+
  private:
   Status sortFile();                    // split source file into sub-runs
-  Status generateRun(int numItems);     // generate one sub-run of file
+  Status nextSource(Record & rec);      // next record of source file
+  Status fillRun(SORTREC* buf, int cap, // copy up to cap source
+		 char*& space, int& spaceSize, // records into space
+		 int& items);
+  Status loadSortRuns();                // runs of maxItems sorted records
+  Status replSelectRuns();              // runs by replacement selection
+  Status parallelRuns();                // loaded runs, by all workers
+  Status runWorker(int cap);            // one worker of parallelRuns()
+  Status generateRun(SORTREC* buf,      // sort buf[0..items-1] and
+		     SORTREC* tmp, int items); // write it out as a run
+  void sortBuffer(SORTREC* buf, SORTREC* tmp, int items) const;
   Status startScans();                  // start a scan on each sorted run
 
+  typedef struct {
+    RID rid;                            // record of a run
+    string attr;                        // its sort attribute
+  } SAMPLE;
+
   typedef struct {
     string name;                        // name of run file
     HeapFileScan* inFile;               // ptr to input file
     InsertFileScan* outFile;		// ptr to output file
-    int valid;                          // TRUE if recPtr has a record
-    Record rec;
+    Record rec;                         // current record of run
     RID rid;                            // RID of current record of run
     RID mark;
+    vector<SAMPLE> samples;             // every SAMPLE_STRIDE-th record
   } RUN;
 
+  Status createRun(RUN & run);          // create a run file for writing
+  Status writeRecord(RUN & run, int i,  // append i-th record to a run
+		     const Record & rec);
+  int fanIn(int mergers) const;         // # of runs each merger can take
+  Status mergePasses(int mergers);      // merge until fanIn() runs left
+  Status parallelMerge();               // merge key ranges in parallel
+  Status mergeRange(const string* lo,   // merge records in [lo, hi) of
+		    const string* hi,   // all runs into out; NULL is
+		    RUN & out);         // unbounded
+  Status advance(RUN & run);            // fetch next record of a run
+  bool before(int a, int b) const;      // compare current records
+  void buildTree();                     // build loser tree over runs
+  void replay(int j);                   // update tree after run j moved
+
   vector<RUN> runs;                   // holds info about each sub-run
+  vector<int> tree;                     // loser tree; tree[0] = winner
+  int pending;                          // run to advance on next(), or -1
+  int runCnt;                           // # of runs generated
+  int passCnt;                          // # of intermediate merge passes
 
-  HeapFile* hfile;                   // source file to sort
   HeapFileScan* hfs;                   // source file to sort
   string fileName;                      // name of source file to sort
   Datatype type;                        // type of sort attribute
   int offset;                           // offset of sort attribute
   int length;                           // length of sort attribute
+  BloomFilter* keys;                    // collects the sort keys
+  const BloomFilter* semiJoin;          // filters the source file
+  RunStrategy strategy;                 // how runs are generated
+  int workers;                          // # of threads
+  mutex lock;                           // source scan, runs, with threads
+  bool held;                            // heldRec did not fit in a run
+  Record heldRec;                       // and is the next source record
 
   SORTREC* buffer;                      // in-memory sort buffer
+  SORTREC* tmpBuffer;                   // scratch space for radix sort
+  char* arena;                          // records of the current run
+  int arenaSize;                        // bytes allocated for arena
   int maxItems;                         // max. # of items/tuples in buffer
   int numItems;                         // current # of items in buffer
 };
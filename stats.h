@@ -0,0 +1,47 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "catalog.h"
+
+
+// Statistics and the estimates derived from them. analyze (see
+// RelCatalog::analyze) stores the page and tuple counts of a relation
+// in relcat, and the number of distinct values and an equi-depth
+// histogram of each attribute in attrcat. A relation that has not been
+// analyzed is assumed to have as many distinct values as tuples in
+// each attribute, its sizes are read from its heap file, and the
+// selectivities of predicates on it are the usual guesses (1/10 for
+// an equality, 1/3 for a range).
+
+
+// The value of an attribute as a real, in the order of the attribute.
+// A string is mapped by its first four characters.
+extern float ST_histKey(const char *value, const Datatype type,
+			const int length);
+
+// Pages and tuples of a relation, and whether they come from analyze.
+extern const Status ST_relSize(const string & relation, int & pages,
+			       int & tuples, bool & analyzed);
+
+// Distinct values of an attribute of a relation with the given number
+// of tuples.
+extern int ST_distinct(const AttrDesc & attr, const int tuples);
+
+// Page reads to find a key in the index on attr, for a relation of the
+// given number of tuples: the bucket of a hash index, or the path from
+// the root of a B+-tree to a leaf.
+extern double ST_probeCost(const AttrDesc & attr, const int tuples);
+
+// Estimated fraction of the tuples whose attribute satisfies
+// "attr op value"; value is in the binary format of the attribute, or
+// a string if the attribute is dictionary encoded.
+extern double ST_selectivity(const AttrDesc & attr, const Operator op,
+			     const char *value);
+
+// Estimated fraction of the pairs of tuples that satisfy
+// "attr1 op attr2", for relations of tuples1 and tuples2 tuples.
+extern double ST_joinSelectivity(const AttrDesc & attr1, const Operator op,
+				 const AttrDesc & attr2, const int tuples1,
+				 const int tuples2);
+
+#endif
@@ -25,8 +25,14 @@ using namespace std;
 const Status UT_Load(const string & relation, 
 		     const string & fileName);
 
+const Status UT_LoadDelimited(const string & relation,
+			      const string & fileName,
+			      const string & delimiter);
+
 const Status UT_Print(string relation);
 
+void   UT_Commit(void);
+
 void   UT_Quit(void);
 
 #endif
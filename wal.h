@@ -0,0 +1,152 @@
+#ifndef WAL_H
+#define WAL_H
+
+#include <sys/types.h>
+#include <condition_variable>
+#include <unordered_map>
+#include <vector>
+#include "page.h"
+#include "db.h"
+
+
+// define if debug output wanted
+//#define DEBUGLOG
+
+
+// The write-ahead log of a database (the file LOGNAME in its
+// directory). Pages of the relations and indexes are not written back
+// to their files but appended to the log, and a statement is durable
+// once the COMMIT record after its pages has been synced. A page that
+// is written again before the next commit overwrites its own frame.
+// Reads find the latest image of a page through an index of the log
+// and go to the file only for pages the log does not have.
+//
+// A checkpoint copies the latest image of every page in the log to
+// its file, syncs the files and starts the log over; it runs when the
+// log has grown past a limit and when minirel quits. After a crash
+// the log is replayed up to its last COMMIT, and whatever follows is
+// undone (see recover).
+//
+// The log starts with a LogHdr; then come frames: a LogFrame, the
+// name of a file (nameLen characters) and, for LOG_PAGE, a Page. The
+// LSN of a frame is its offset in the log. A frame counts only if its
+// salt is that of the header and its checksum holds, so frames of an
+// older log and torn writes end the log.
+
+#define LOGNAME   "wal"
+#define LOGMAGIC  "MRWAL001"
+
+enum LogType {LOG_PAGE, LOG_COMMIT, LOG_CREATE, LOG_DROP};
+
+struct LogHdr
+{
+  char magic[8];              // LOGMAGIC
+  unsigned int salt;          // changes at every checkpoint
+};
+
+struct LogFrame
+{
+  unsigned int salt;          // salt of the log the frame belongs to
+  unsigned int checksum;      // of the rest of the frame, name and page
+  int type;                   // a LogType
+  int pageNo;                 // LOG_PAGE: page of the file
+  int nameLen;                // length of the file name that follows
+};
+
+
+class LogMgr {
+ public:
+  LogMgr(const string & fileName,      // open the log and recover
+	 Status & status);
+  ~LogMgr();
+
+  // the latest image of a page, or HASHNOTFOUND if the log has none
+  const Status readPage(const string & fileName, const int pageNo,
+			Page* page);
+  const Status writePage(const string & fileName, const int pageNo,
+			 const Page* page);
+
+  // a file was created; it is removed again if the log is replayed
+  // without the commit that follows
+  const Status createFile(const string & fileName);
+  // remove a file once the statement commits
+  const Status destroyFile(const string & fileName);
+
+  // make everything written so far durable: the dirty pages of the
+  // buffer pool go to the log, followed by a COMMIT record, and the
+  // log is synced together with those of concurrent commits
+  const Status commit();
+
+  // a thread that defers its syncs gets back from commit once the
+  // COMMIT record is written, and waits for the sync in syncDeferred:
+  // the sessions of the server commit their statements one at a time
+  // but sync them together
+  static void deferSyncs(const bool defer) { deferring = defer; }
+  const Status syncDeferred();
+
+  // write the pages in the log back to their files and empty the log
+  const Status checkpoint();
+
+  // commits wait delay microseconds before they sync, so that more
+  // of them share a sync; a checkpoint runs after frames frames
+  void setCommitDelay(const int delay) { commitDelay = delay; }
+  void setCheckpointFrames(const int frames) { ckptFrames = frames; }
+
+  // for crash tests: exit after the n-th write of the log or of a
+  // checkpoint, which is torn in half if torn is set
+  void setCrashPoint(const int n, const bool torn)
+  {
+    crashAt = n;
+    crashTorn = torn;
+  }
+
+ private:
+  struct Commit
+  {
+    off_t lsn;                  // end of the COMMIT record, 0 if none
+    unsigned int salt;          // of the log it is in
+    vector<string> drops;       // files to remove once it is durable
+  };
+  const Status finish(Commit & commit);
+
+  const Status recover();
+  const Status append(const LogType type, const string & fileName,
+		      const int pageNo, const Page* page, off_t & lsn);
+  const Status put(const int fd, const void* buf, const size_t len,
+		   const off_t offset);
+  const Status sync(const off_t lsn, const unsigned int logSalt);
+  const Status reset();
+  unsigned int checksum(const LogFrame & frame, const string & fileName,
+			const Page* page) const;
+
+  // name a dropped file has until its drop commits
+  static string dropName(const string & fileName, const off_t lsn);
+
+  typedef unordered_map<int, off_t> PageMap;  // page -> LSN of its frame
+
+  int fd;                       // the log
+  unsigned int salt;
+  off_t end;                    // where the next frame goes
+  off_t committed;              // end of the last COMMIT record
+  off_t durable;                // end of what has been synced
+  bool syncing;                 // a commit is syncing the log
+  int frames;                   // frames since the last checkpoint
+  unordered_map<string, PageMap> pages;  // the latest frame of each page
+  vector<string> dropped;       // to remove at the next commit
+
+  int commitDelay;
+  int ckptFrames;
+  int crashAt;
+  bool crashTorn;
+  int writes;                   // writes counted for crashAt
+  int commits;
+  bool committing;              // writing a COMMIT record
+
+  static thread_local bool deferring;
+  static thread_local Commit deferred;  // the thread's last commit
+
+  std::mutex mutex;             // serializes threads (sessions)
+  condition_variable synced;    // durable moved
+};
+
+#endif